@@ -8,7 +8,8 @@ class Layer {
 public:
     Layer(int input_size, int output_size, ActivationType activation);
     
-    Eigen::MatrixXd forward(const Eigen::MatrixXd &input);
+    // temperature divides the pre-activations, e.g. softmax(Z / T) for distillation
+    Eigen::MatrixXd forward(const Eigen::MatrixXd &input, double temperature = 1.0);
 
     Eigen::MatrixXd W; // Weights matrix (output_size x input_size)
     Eigen::VectorXd b; // Bias vector (output_size)
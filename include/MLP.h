@@ -3,24 +3,46 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include <Eigen/Dense>
 #include "Layer.h"
 #include "Activations.h"
 #include "Losses.h"
 #include "Optimizer.h"
+#include "Numa.h"
 
 class MLP {
 public:
     MLP(const std::vector<int> &layers, const std::vector<ActivationType> &activations);
+    MLP(const MLP &other); // Deep copy, e.g. a per-node replica for inference
+    MLP &operator=(const MLP &other);
     ~MLP();
 
-    Eigen::MatrixXd forward(const Eigen::MatrixXd &X);
+    // temperature only applies to the output layer; serving always uses 1
+    Eigen::MatrixXd forward(const Eigen::MatrixXd &X, double temperature = 1.0);
     void backward(const Eigen::MatrixXd &X, const Eigen::MatrixXd &Y, double learning_rate, const Eigen::MatrixXd &dL_dY);
     void train(const Eigen::MatrixXd &train_X, const Eigen::MatrixXd &train_Y, int epochs, double learning_rate, LossType loss_type = LossType::CROSS_ENTROPY);
+    // Knowledge distillation: minimises alpha * T^2 * CE(softmax(z / T), soft_Y) + (1 - alpha) * CE(softmax(z), train_Y),
+    // where soft_Y are the teacher's outputs at the same temperature. Requires a softmax output layer
+    void distill(const Eigen::MatrixXd &train_X, const Eigen::MatrixXd &train_Y, const Eigen::MatrixXd &soft_Y,
+                 int epochs, double learning_rate, double temperature, double alpha);
     double accuracy(const Eigen::MatrixXd &X, const Eigen::MatrixXd &Y);
     void saveWeights(const std::string &filename);
     void loadWeights(const std::string &filename);
 
+    // Structured pruning: drops the given fraction of neurons from every hidden layer,
+    // scoring each neuron on the calibration batch and folding removed ones into the next bias
+    void pruneNeurons(double ratio, const Eigen::MatrixXd &calib_X);
+
+    std::vector<int> layerSizes() const;
+    ActivationType outputActivation() const;
+    long long parameterCount() const;
+    long long flopsPerSample() const;
+
+    // One copy per Numa::runWorkers worker, each built on that worker's thread under the policy. Only NODE
+    // gives per-node copies; INTERLEAVE spreads every copy over all nodes and NONE builds all on the calling thread
+    std::vector<std::unique_ptr<MLP>> replicate(NumaPolicy policy, int threads_per_node) const;
+
 private:
     std::vector<Layer> network_layers;
     Optimizer* optimizer; // Pointer to the optimizer (e.g., SGD)
@@ -0,0 +1,35 @@
+#ifndef NUMA_H
+#define NUMA_H
+
+#include <string>
+#include <functional>
+#include <vector>
+
+enum class NumaPolicy {
+    NONE,       // Leave placement to the OS (first touch by whichever thread writes)
+    INTERLEAVE, // Spread allocations page by page over all nodes
+    NODE        // Pin each thread to a node and keep its allocations on that node
+};
+
+// Thin wrapper over libnuma. Every call is a no-op when libnuma is missing
+// or the machine has a single node, so the same code runs anywhere.
+class Numa {
+public:
+    static bool available();
+    static std::vector<int> nodes(); // IDs of the nodes with memory, {0} without libnuma
+    static int nodeCount();
+    static NumaPolicy parsePolicy(const std::string &policy_str);
+    static std::string policyName(NumaPolicy policy);
+
+    // Applies the policy to the calling thread; memory it touches afterwards follows it.
+    // Throws if the thread cannot be pinned to the node
+    static void applyToCurrentThread(NumaPolicy policy, int node);
+    static void resetCurrentThread();
+
+    // Runs fn(worker, node) on threads_per_node threads for every node and waits for them,
+    // with the policy applied to each thread before fn is called. worker is
+    // n * threads_per_node + t where n is the node's position in nodes()
+    static void runWorkers(NumaPolicy policy, int threads_per_node, const std::function<void(int, int)> &fn);
+};
+
+#endif
@@ -4,19 +4,40 @@
 #include <vector>
 #include <string>
 #include <Eigen/Dense>
+#include "Activations.h"
+#include "Numa.h"
 
 struct NetworkConfig {
     std::vector<int> layer_sizes;
     std::vector<std::string> activation_strs;
     int epochs;
     double learning_rate;
+    NumaPolicy numa_policy;
+};
+
+struct CompressConfig {
+    std::string weights_in;
+    std::string weights_out;
+    std::vector<int> student_sizes;          // empty: prune the teacher itself
+    std::vector<std::string> student_activation_strs;
+    double prune_ratio;
+    bool distill;
+    double temperature;
+    double alpha;                            // weight of the teacher's soft targets
+    std::string eval_data;                   // empty: report on the last 10000 train samples
+    std::string eval_labels;
+    int eval_samples;
+    int epochs;
+    double learning_rate;
 };
 
 class Utilities {
 public:
     static NetworkConfig parseArguments(int argc, char** argv);
     static std::vector<int> parseLayerSizes(const std::string &sizes_str);
+    static CompressConfig parseCompressArguments(int argc, char** argv);
     static std::vector<std::string> parseActivations(const std::string &act_str);
+    static std::vector<ActivationType> toActivationTypes(const std::vector<std::string> &act_strs);
     static Eigen::MatrixXd loadCSV(const std::string &filename, int rows, int cols);
 };
 
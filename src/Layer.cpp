@@ -24,9 +24,12 @@ Layer::Layer(int input_size, int output_size, ActivationType activation) : W(out
     b.setZero();
 }
 
-Eigen::MatrixXd Layer::forward(const Eigen::MatrixXd &input) {
+Eigen::MatrixXd Layer::forward(const Eigen::MatrixXd &input, double temperature) {
     input_cache = input; // Cache for backpropagation
     Eigen::MatrixXd Z = (W * input).colwise() + b;
+    if (temperature != 1.0) {
+        Z /= temperature;
+    }
     output_cache = Activations::activate(Z, activation_type);
     return output_cache;
 }
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <random>
 #include <algorithm>
+#include <numeric>
+#include <cmath>
 #include <stdexcept>
 #include <fstream> // Added to resolve std::ofstream and std::ifstream errors
 
@@ -38,14 +40,39 @@ MLP::MLP(const std::vector<int> &layers, const std::vector<ActivationType> &acti
     optimizer = new SGD(0.01);
 }
 
+// Copies weights, biases and activations but not the forward caches, which can be large after
+// accuracy() on a big batch and would otherwise be duplicated into every replica
+static std::vector<Layer> copyLayers(const std::vector<Layer> &layers) {
+    std::vector<Layer> copies;
+    copies.reserve(layers.size());
+    for (auto &layer : layers) {
+        Layer copy((int)layer.W.cols(), (int)layer.W.rows(), layer.activation_type);
+        copy.W = layer.W;
+        copy.b = layer.b;
+        copies.push_back(copy);
+    }
+    return copies;
+}
+
+MLP::MLP(const MLP &other) : network_layers(copyLayers(other.network_layers)) {
+    optimizer = new SGD(0.01);
+}
+
+MLP &MLP::operator=(const MLP &other) {
+    if (this != &other) {
+        network_layers = copyLayers(other.network_layers);
+    }
+    return *this;
+}
+
 MLP::~MLP() {
     delete optimizer;
 }
 
-Eigen::MatrixXd MLP::forward(const Eigen::MatrixXd &X) {
+Eigen::MatrixXd MLP::forward(const Eigen::MatrixXd &X, double temperature) {
     Eigen::MatrixXd out = X;
-    for (auto &layer : network_layers) {
-        out = layer.forward(out);
+    for (size_t i = 0; i < network_layers.size(); ++i) {
+        out = network_layers[i].forward(out, i + 1 == network_layers.size() ? temperature : 1.0);
     }
     return out;
 }
@@ -114,6 +141,59 @@ void MLP::train(const Eigen::MatrixXd &train_X, const Eigen::MatrixXd &train_Y,
     }
 }
 
+void MLP::distill(const Eigen::MatrixXd &train_X, const Eigen::MatrixXd &train_Y, const Eigen::MatrixXd &soft_Y,
+                  int epochs, double learning_rate, double temperature, double alpha) {
+    if (train_X.cols() == 0 || train_Y.cols() == 0 || soft_Y.cols() != train_Y.cols() || soft_Y.rows() != train_Y.rows()) {
+        throw std::runtime_error("Empty or mismatched distillation data provided.");
+    }
+    if (network_layers.back().activation_type != ActivationType::SOFTMAX) {
+        throw std::runtime_error("Distillation requires a softmax output layer.");
+    }
+
+    // Hard and soft targets are stacked so one shuffle keeps them aligned
+    int classes = (int)train_Y.rows();
+    Eigen::MatrixXd X = train_X;
+    Eigen::MatrixXd Y(2 * classes, train_Y.cols());
+    Y << train_Y, soft_Y;
+
+    int batch_size = 64;
+    int num_samples = X.cols();
+    if (num_samples < batch_size) {
+        throw std::runtime_error("Not enough samples to form a single batch.");
+    }
+    int num_batches = num_samples / batch_size;
+
+    for (int e = 0; e < epochs; ++e) {
+        shuffleData(X, Y);
+        double epoch_loss = 0.0;
+        for (int b = 0; b < num_batches; b++) {
+            int start = b * batch_size;
+            Eigen::MatrixXd X_batch = X.block(0, start, X.rows(), batch_size);
+            Eigen::MatrixXd Y_batch = Y.block(0, start, classes, batch_size);
+            Eigen::MatrixXd soft_batch = Y.block(classes, start, classes, batch_size);
+
+            // The second pass leaves the caches at T = 1; the hidden activations are the same in both
+            Eigen::MatrixXd P_soft = forward(X_batch, temperature);
+            Eigen::MatrixXd P_hard = forward(X_batch);
+
+            double loss = alpha * temperature * temperature * Losses::crossEntropy(P_soft, soft_batch)
+                        + (1.0 - alpha) * Losses::crossEntropy(P_hard, Y_batch);
+
+            // Gradient w.r.t. the output logits; d(z / T)/dz contributes 1/T, which cancels one factor of T^2
+            Eigen::MatrixXd dL_dZ = alpha * temperature * Losses::crossEntropy_derivative(P_soft, soft_batch)
+                                  + (1.0 - alpha) * Losses::crossEntropy_derivative(P_hard, Y_batch);
+
+            epoch_loss += loss;
+            backward(X_batch, Y_batch, learning_rate, dL_dZ);
+        }
+
+        epoch_loss /= num_batches;
+        if (e % 100 == 0 || e == epochs - 1) {
+            std::cout << "Epoch " << e << ", Loss: " << epoch_loss << std::endl;
+        }
+    }
+}
+
 double MLP::accuracy(const Eigen::MatrixXd &X, const Eigen::MatrixXd &Y) {
     if (X.cols() == 0 || Y.cols() == 0) {
         throw std::runtime_error("Empty data provided for accuracy calculation.");
@@ -199,3 +279,110 @@ void MLP::loadWeights(const std::string &filename) {
     }
     f.close();
 }
+
+void MLP::pruneNeurons(double ratio, const Eigen::MatrixXd &calib_X) {
+    if (ratio < 0.0 || ratio >= 1.0) {
+        throw std::runtime_error("Pruning ratio must be in [0, 1).");
+    }
+    if (calib_X.cols() == 0) {
+        throw std::runtime_error("Empty calibration data provided for pruning.");
+    }
+
+    // The output layer is never pruned, only the hidden layers feeding it
+    for (size_t i = 0; i + 1 < network_layers.size(); ++i) {
+        // Re-run the forward pass so the statistics reflect the layers already pruned
+        forward(calib_X);
+
+        Layer &layer = network_layers[i];
+        Layer &next = network_layers[i + 1];
+        int n = (int)layer.W.rows();
+        int keep = std::max(1, (int)std::lround(n * (1.0 - ratio)));
+        if (keep >= n) continue;
+
+        // A neuron whose output barely varies can be replaced by its mean, so score it by
+        // the spread of its activation times the size of its outgoing weights
+        Eigen::VectorXd mean = layer.output_cache.rowwise().mean();
+        Eigen::VectorXd stddev = (layer.output_cache.colwise() - mean).array().square().rowwise().mean().sqrt();
+        std::vector<double> score(n);
+        for (int j = 0; j < n; j++) score[j] = stddev(j) * next.W.col(j).norm();
+
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int c) { return score[a] > score[c]; });
+        std::vector<int> kept(order.begin(), order.begin() + keep);
+        std::sort(kept.begin(), kept.end());
+
+        // Fold the average contribution of the removed neurons into the next layer's bias
+        for (int r = keep; r < n; r++) {
+            next.b += next.W.col(order[r]) * mean(order[r]);
+        }
+
+        Eigen::MatrixXd W(keep, layer.W.cols());
+        Eigen::VectorXd b(keep);
+        Eigen::MatrixXd next_W(next.W.rows(), keep);
+        for (int k = 0; k < keep; k++) {
+            W.row(k) = layer.W.row(kept[k]);
+            b(k) = layer.b(kept[k]);
+            next_W.col(k) = next.W.col(kept[k]);
+        }
+        layer.W = W;
+        layer.b = b;
+        next.W = next_W;
+    }
+
+    // Drop caches sized for the old topology
+    for (auto &layer : network_layers) {
+        layer.input_cache.resize(0, 0);
+        layer.output_cache.resize(0, 0);
+    }
+}
+
+std::vector<int> MLP::layerSizes() const {
+    std::vector<int> sizes;
+    if (network_layers.empty()) return sizes;
+    sizes.push_back((int)network_layers.front().W.cols());
+    for (auto &layer : network_layers) {
+        sizes.push_back((int)layer.W.rows());
+    }
+    return sizes;
+}
+
+ActivationType MLP::outputActivation() const {
+    if (network_layers.empty()) {
+        throw std::runtime_error("Network has no layers.");
+    }
+    return network_layers.back().activation_type;
+}
+
+long long MLP::parameterCount() const {
+    long long count = 0;
+    for (auto &layer : network_layers) {
+        count += layer.W.size() + layer.b.size();
+    }
+    return count;
+}
+
+long long MLP::flopsPerSample() const {
+    // One multiply and one add per weight, plus the bias add; activations are not counted
+    long long flops = 0;
+    for (auto &layer : network_layers) {
+        flops += 2LL * layer.W.size() + layer.b.size();
+    }
+    return flops;
+}
+
+std::vector<std::unique_ptr<MLP>> MLP::replicate(NumaPolicy policy, int threads_per_node) const {
+    if (threads_per_node <= 0) {
+        throw std::runtime_error("Number of threads per node must be positive.");
+    }
+    std::vector<std::unique_ptr<MLP>> replicas(Numa::nodeCount() * threads_per_node);
+    if (policy == NumaPolicy::NONE) {
+        for (auto &replica : replicas) replica.reset(new MLP(*this));
+    } else {
+        Numa::runWorkers(policy, threads_per_node, [&](int worker, int node) {
+            (void)node;
+            replicas[worker].reset(new MLP(*this));
+        });
+    }
+    return replicas;
+}
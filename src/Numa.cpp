@@ -0,0 +1,113 @@
+#include "Numa.h"
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <exception>
+#include <cerrno>
+#include <cstring>
+#ifdef HAVE_LIBNUMA
+#include <numa.h>
+#endif
+
+bool Numa::available() {
+    return nodeCount() > 1;
+}
+
+std::vector<int> Numa::nodes() {
+#ifdef HAVE_LIBNUMA
+    if (numa_available() < 0) return {0};
+    // Node IDs can be sparse, and memoryless nodes are not in numa_all_nodes_ptr
+    std::vector<int> ids;
+    for (int node = 0; node <= numa_max_node(); node++) {
+        if (numa_bitmask_isbitset(numa_all_nodes_ptr, node)) ids.push_back(node);
+    }
+    if (ids.empty()) return {0};
+    return ids;
+#else
+    return {0};
+#endif
+}
+
+int Numa::nodeCount() {
+    return (int)nodes().size();
+}
+
+NumaPolicy Numa::parsePolicy(const std::string &policy_str) {
+    if (policy_str == "none") return NumaPolicy::NONE;
+    if (policy_str == "interleave") return NumaPolicy::INTERLEAVE;
+    if (policy_str == "node") return NumaPolicy::NODE;
+    throw std::runtime_error("Unknown NUMA policy: " + policy_str + ". Must be none, interleave or node.");
+}
+
+std::string Numa::policyName(NumaPolicy policy) {
+    switch(policy) {
+        case NumaPolicy::NONE:
+            return "none";
+        case NumaPolicy::INTERLEAVE:
+            return "interleave";
+        case NumaPolicy::NODE:
+            return "node";
+        default:
+            throw std::runtime_error("Unknown NUMA policy.");
+    }
+}
+
+void Numa::applyToCurrentThread(NumaPolicy policy, int node) {
+    if (!available()) return;
+#ifdef HAVE_LIBNUMA
+    switch(policy) {
+        case NumaPolicy::NONE:
+            break;
+        case NumaPolicy::INTERLEAVE:
+            numa_set_interleave_mask(numa_all_nodes_ptr);
+            break;
+        case NumaPolicy::NODE:
+            if (numa_run_on_node(node) != 0) {
+                throw std::runtime_error("Could not pin thread to NUMA node " + std::to_string(node) + ": " + std::strerror(errno));
+            }
+            numa_set_preferred(node);
+            break;
+    }
+#else
+    (void)policy;
+    (void)node;
+#endif
+}
+
+void Numa::resetCurrentThread() {
+    if (!available()) return;
+#ifdef HAVE_LIBNUMA
+    if (numa_run_on_node(-1) != 0) { // Any node
+        throw std::runtime_error(std::string("Could not unpin thread from its NUMA node: ") + std::strerror(errno));
+    }
+    numa_set_localalloc();
+#endif
+}
+
+void Numa::runWorkers(NumaPolicy policy, int threads_per_node, const std::function<void(int, int)> &fn) {
+    if (threads_per_node <= 0) {
+        throw std::runtime_error("Number of threads per node must be positive.");
+    }
+    std::vector<int> ids = nodes();
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(ids.size() * threads_per_node);
+    for (int n = 0; n < (int)ids.size(); n++) {
+        int node = ids[n];
+        for (int t = 0; t < threads_per_node; t++) {
+            int worker = n * threads_per_node + t;
+            workers.emplace_back([=, &fn, &errors]() {
+                try {
+                    applyToCurrentThread(policy, node);
+                    fn(worker, node);
+                } catch (...) {
+                    errors[worker] = std::current_exception();
+                }
+            });
+        }
+    }
+    for (auto &w : workers) w.join();
+    // Surface worker failures on the calling thread
+    for (auto &e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
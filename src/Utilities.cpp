@@ -22,6 +22,7 @@ NetworkConfig Utilities::parseArguments(int argc, char** argv) {
     config.activation_strs = {"sigmoid", "sigmoid"};
     config.epochs = 10;
     config.learning_rate = 0.01;
+    config.numa_policy = NumaPolicy::NONE;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -49,6 +50,8 @@ NetworkConfig Utilities::parseArguments(int argc, char** argv) {
             } catch (...) {
                 throw std::runtime_error("Invalid value for --lr. Must be a floating point number.");
             }
+        } else if (arg == "--numa" && i + 1 < argc) {
+            config.numa_policy = Numa::parsePolicy(argv[++i]);
         } else {
             throw std::runtime_error("Unknown argument: " + arg);
         }
@@ -62,6 +65,121 @@ NetworkConfig Utilities::parseArguments(int argc, char** argv) {
     return config;
 }
 
+CompressConfig Utilities::parseCompressArguments(int argc, char** argv) {
+    CompressConfig config;
+    // Defaults
+    config.weights_in = "weights.bin";
+    config.weights_out = "weights_compressed.bin";
+    config.prune_ratio = 0.0;
+    config.distill = false;
+    config.temperature = 2.0;
+    config.alpha = 0.5;
+    config.eval_samples = 10000;
+    config.epochs = 10;
+    config.learning_rate = 0.01;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "--weights" || arg == "-w") && i + 1 < argc) {
+            config.weights_in = argv[++i];
+        } else if ((arg == "--out" || arg == "-o") && i + 1 < argc) {
+            config.weights_out = argv[++i];
+        } else if ((arg == "--sizes" || arg == "-s") && i + 1 < argc) {
+            config.student_sizes = parseLayerSizes(argv[++i]);
+        } else if ((arg == "--activations" || arg == "-a") && i + 1 < argc) {
+            config.student_activation_strs = parseActivations(argv[++i]);
+        } else if (arg == "--prune" && i + 1 < argc) {
+            std::string val_str = argv[++i];
+            try {
+                config.prune_ratio = std::stod(val_str);
+                if (config.prune_ratio < 0.0 || config.prune_ratio >= 1.0) {
+                    throw std::runtime_error("Pruning ratio must be in [0, 1).");
+                }
+            } catch (...) {
+                throw std::runtime_error("Invalid value for --prune. Must be a number in [0, 1).");
+            }
+        } else if (arg == "--distill") {
+            config.distill = true;
+        } else if ((arg == "--temperature" || arg == "-T") && i + 1 < argc) {
+            std::string val_str = argv[++i];
+            try {
+                config.temperature = std::stod(val_str);
+                if (config.temperature <= 0.0) {
+                    throw std::runtime_error("Temperature must be positive.");
+                }
+            } catch (...) {
+                throw std::runtime_error("Invalid value for --temperature. Must be a positive number.");
+            }
+        } else if (arg == "--alpha" && i + 1 < argc) {
+            std::string val_str = argv[++i];
+            try {
+                config.alpha = std::stod(val_str);
+                if (config.alpha < 0.0 || config.alpha > 1.0) {
+                    throw std::runtime_error("Alpha must be in [0, 1].");
+                }
+            } catch (...) {
+                throw std::runtime_error("Invalid value for --alpha. Must be a number in [0, 1].");
+            }
+        } else if (arg == "--eval-data" && i + 1 < argc) {
+            config.eval_data = argv[++i];
+        } else if (arg == "--eval-labels" && i + 1 < argc) {
+            config.eval_labels = argv[++i];
+        } else if (arg == "--eval-samples" && i + 1 < argc) {
+            std::string val_str = argv[++i];
+            try {
+                config.eval_samples = std::stoi(val_str);
+                if (config.eval_samples <= 0) {
+                    throw std::runtime_error("Number of evaluation samples must be positive.");
+                }
+            } catch (...) {
+                throw std::runtime_error("Invalid value for --eval-samples. Must be a positive integer.");
+            }
+        } else if ((arg == "--epochs" || arg == "-e") && i + 1 < argc) {
+            std::string val_str = argv[++i];
+            try {
+                config.epochs = std::stoi(val_str);
+                if (config.epochs < 0) {
+                    throw std::runtime_error("Number of epochs cannot be negative.");
+                }
+            } catch (...) {
+                throw std::runtime_error("Invalid value for --epochs. Must be an integer.");
+            }
+        } else if ((arg == "--lr" || arg == "--learning_rate") && i + 1 < argc) {
+            std::string val_str = argv[++i];
+            try {
+                config.learning_rate = std::stod(val_str);
+                if (config.learning_rate <= 0.0) {
+                    throw std::runtime_error("Learning rate must be positive.");
+                }
+            } catch (...) {
+                throw std::runtime_error("Invalid value for --lr. Must be a floating point number.");
+            }
+        } else {
+            throw std::runtime_error("Unknown argument: " + arg);
+        }
+    }
+
+    // A student topology needs both its sizes and its activations
+    if (config.student_sizes.empty() != config.student_activation_strs.empty()) {
+        throw std::runtime_error("--sizes and --activations must be given together.");
+    }
+    if (!config.student_sizes.empty() && config.student_activation_strs.size() != config.student_sizes.size() - 1) {
+        throw std::runtime_error("Number of activations must be one less than number of layer sizes.");
+    }
+    if (!config.student_sizes.empty() && !config.distill) {
+        throw std::runtime_error("A student topology given by --sizes requires --distill.");
+    }
+    if (config.eval_data.empty() != config.eval_labels.empty()) {
+        throw std::runtime_error("--eval-data and --eval-labels must be given together.");
+    }
+    // Pruning scores come from trained weights, a freshly initialised student has none
+    if (!config.student_sizes.empty() && config.prune_ratio > 0.0) {
+        throw std::runtime_error("--prune cannot be combined with a student topology given by --sizes.");
+    }
+
+    return config;
+}
+
 std::vector<int> Utilities::parseLayerSizes(const std::string &sizes_str) {
     auto parts = splitString(sizes_str, ',');
     std::vector<int> sizes;
@@ -91,6 +209,22 @@ std::vector<std::string> Utilities::parseActivations(const std::string &act_str)
     return activations;
 }
 
+std::vector<ActivationType> Utilities::toActivationTypes(const std::vector<std::string> &act_strs) {
+    std::vector<ActivationType> activations;
+    for (auto &as : act_strs) {
+        if (as == "sigmoid") {
+            activations.push_back(ActivationType::SIGMOID);
+        } else if (as == "relu") {
+            activations.push_back(ActivationType::RELU);
+        } else if (as == "softmax") {
+            activations.push_back(ActivationType::SOFTMAX);
+        } else {
+            throw std::runtime_error("Unknown activation function: " + as);
+        }
+    }
+    return activations;
+}
+
 Eigen::MatrixXd Utilities::loadCSV(const std::string &filename, int rows, int cols) {
     Eigen::MatrixXd mat(rows, cols);
     std::ifstream file(filename);
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include "MLP.h"
+#include "Utilities.h"
+#include "Numa.h"
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Undoes the policy on the calling thread even if training throws, so the baselines that follow run unpinned
+struct ThreadPolicyGuard {
+    ThreadPolicyGuard(NumaPolicy policy, int node) { Numa::applyToCurrentThread(policy, node); }
+    ~ThreadPolicyGuard() {
+        try {
+            Numa::resetCurrentThread();
+        } catch (const std::runtime_error &e) {
+            std::cerr << "Warning: " << e.what() << std::endl;
+        }
+    }
+};
+
+// Training samples/s; the dataset and model are copied under the policy so first touch follows it
+static double trainThroughput(const MLP &initial, const Eigen::MatrixXd &X, const Eigen::MatrixXd &Y,
+                              int epochs, double learning_rate, NumaPolicy policy) {
+    ThreadPolicyGuard guard(policy, Numa::nodes().front());
+    MLP mlp(initial);
+    Eigen::MatrixXd local_X = X;
+    Eigen::MatrixXd local_Y = Y;
+
+    auto start = std::chrono::steady_clock::now();
+    mlp.train(local_X, local_Y, epochs, learning_rate, LossType::CROSS_ENTROPY);
+    double elapsed = seconds(start);
+
+    long long samples = (long long)epochs * (X.cols() / 64) * 64; // train() drops the last partial batch
+    return samples / elapsed;
+}
+
+// Inference samples/s over all workers. With node every worker is pinned and its weights replica and
+// data shard are first-touched on its node; with interleave both are spread over all nodes; with none
+// the replicas are built and the data loaded by the main thread, so unpinned workers read wherever that landed
+static double inferenceThroughput(const MLP &model, const Eigen::MatrixXd &X, int threads_per_node,
+                                  int passes, NumaPolicy policy) {
+    int workers = Numa::nodeCount() * threads_per_node;
+    int shard_size = (int)X.cols() / workers;
+    int batch_size = 64;
+    std::vector<double> elapsed(workers);
+    // Forward caches activations, so workers cannot share one MLP
+    std::vector<std::unique_ptr<MLP>> replicas = model.replicate(policy, threads_per_node);
+
+    Numa::runWorkers(policy, threads_per_node, [&](int worker, int node) {
+        (void)node;
+        MLP &replica = *replicas[worker];
+        Eigen::MatrixXd local_shard;
+        int offset = worker * shard_size;
+        if (policy != NumaPolicy::NONE) {
+            local_shard = X.middleCols(offset, shard_size);
+            offset = 0;
+        }
+        const Eigen::MatrixXd &source = policy != NumaPolicy::NONE ? local_shard : X;
+
+        // Only the forward passes are timed, not building the shard
+        auto start = std::chrono::steady_clock::now();
+        for (int p = 0; p < passes; p++) {
+            for (int start_col = 0; start_col < shard_size; start_col += batch_size) {
+                int n = std::min(batch_size, shard_size - start_col);
+                replica.forward(source.middleCols(offset + start_col, n));
+            }
+        }
+        elapsed[worker] = seconds(start);
+    });
+
+    double slowest = *std::max_element(elapsed.begin(), elapsed.end());
+    return (double)workers * shard_size * passes / slowest;
+}
+
+int main(int argc, char** argv) {
+    try {
+        NetworkConfig config = Utilities::parseArguments(argc, argv);
+        // none is always measured as the baseline, so compare it against node
+        NumaPolicy policy = config.numa_policy == NumaPolicy::NONE ? NumaPolicy::NODE : config.numa_policy;
+        if (config.numa_policy == NumaPolicy::NONE) {
+            std::cout << "--numa none is the baseline, comparing against --numa node\n";
+        }
+
+        int nodes = Numa::nodeCount();
+        int threads_per_node = std::max(1, (int)std::thread::hardware_concurrency() / nodes);
+        std::cout << "NUMA nodes: " << nodes << ", inference threads per node: " << threads_per_node;
+        if (!Numa::available()) {
+            std::cout << " (single node, the policy is a no-op)";
+        }
+        std::cout << "\n";
+
+        MLP initial(config.layer_sizes, Utilities::toActivationTypes(config.activation_strs));
+
+        // Load training data on the main thread, as train does
+        Eigen::MatrixXd train_X = Utilities::loadCSV("data/train_data.csv", 784, 60000);
+        Eigen::MatrixXd train_Y = Utilities::loadCSV("data/train_labels.csv", 10, 60000);
+
+        double train_none = trainThroughput(initial, train_X, train_Y, config.epochs, config.learning_rate, NumaPolicy::NONE);
+        double train_numa = trainThroughput(initial, train_X, train_Y, config.epochs, config.learning_rate, policy);
+
+        int passes = 5;
+        double infer_none = inferenceThroughput(initial, train_X, threads_per_node, passes, NumaPolicy::NONE);
+        double infer_numa = inferenceThroughput(initial, train_X, threads_per_node, passes, policy);
+
+        std::cout << "\n" << std::left << std::setw(24) << "Samples/s" << std::setw(16) << "--numa none"
+                  << std::setw(20) << ("--numa " + Numa::policyName(policy)) << "Speedup\n";
+        std::cout << std::fixed << std::setprecision(0)
+                  << std::setw(24) << "training" << std::setw(16) << train_none << std::setw(20) << train_numa
+                  << std::setprecision(2) << train_numa / train_none << "x\n"
+                  << std::setprecision(0)
+                  << std::setw(24) << "inference" << std::setw(16) << infer_none << std::setw(20) << infer_numa
+                  << std::setprecision(2) << infer_numa / infer_none << "x\n";
+
+    } catch (const std::runtime_error &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
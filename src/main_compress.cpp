@@ -0,0 +1,128 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <utility>
+#include "MLP.h"
+#include "Utilities.h"
+
+// The teacher's output distribution at temperature T, computed from its logits
+static Eigen::MatrixXd softTargets(MLP &teacher, const Eigen::MatrixXd &X, double temperature) {
+    Eigen::MatrixXd P(teacher.layerSizes().back(), X.cols());
+    int chunk = 10000; // Keep the hidden activations of the teacher small
+    for (int start = 0; start < X.cols(); start += chunk) {
+        int n = std::min(chunk, (int)X.cols() - start);
+        P.middleCols(start, n) = teacher.forward(X.middleCols(start, n), temperature);
+    }
+    return P;
+}
+
+// Average single-sample forward latency, which is what a serving request pays
+static double latencyMs(MLP &mlp, const Eigen::MatrixXd &X, int samples) {
+    samples = std::min(samples, (int)X.cols());
+    mlp.forward(X.col(0)); // Warm up
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        mlp.forward(X.col(i));
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / samples;
+}
+
+static std::string topology(const std::vector<int> &sizes) {
+    std::string s;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (i > 0) s += "-";
+        s += std::to_string(sizes[i]);
+    }
+    return s;
+}
+
+static void printReport(const std::string &name, MLP &mlp, const Eigen::MatrixXd &eval_X, const Eigen::MatrixXd &eval_Y) {
+    double acc = mlp.accuracy(eval_X, eval_Y);
+    double latency = latencyMs(mlp, eval_X, 1000);
+    std::cout << std::left << std::setw(12) << name
+              << std::setw(28) << topology(mlp.layerSizes())
+              << std::setw(12) << mlp.parameterCount()
+              << std::setw(14) << mlp.flopsPerSample()
+              << std::setw(14) << std::fixed << std::setprecision(4) << latency
+              << std::setprecision(2) << acc * 100 << "%\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+int main(int argc, char** argv) {
+    try {
+        CompressConfig config = Utilities::parseCompressArguments(argc, argv);
+
+        // The topology is replaced by the one stored in the weights file
+        MLP teacher({784, 10}, {ActivationType::SOFTMAX});
+        teacher.loadWeights(config.weights_in);
+        std::vector<int> teacher_sizes = teacher.layerSizes();
+
+        // Either a fresh student topology or a copy of the teacher to prune
+        bool fresh_student = !config.student_sizes.empty();
+        if (fresh_student && (config.student_sizes.front() != teacher_sizes.front() || config.student_sizes.back() != teacher_sizes.back())) {
+            throw std::runtime_error("Student input and output sizes must match the teacher (" + topology(teacher_sizes) + ").");
+        }
+        MLP student(fresh_student ? config.student_sizes : std::vector<int>{784, 10},
+                     fresh_student ? Utilities::toActivationTypes(config.student_activation_strs) : std::vector<ActivationType>{ActivationType::SOFTMAX});
+        if (!fresh_student) {
+            student.loadWeights(config.weights_in);
+        }
+        // Temperature softening and the soft-target loss both rely on a softmax output layer
+        if (config.distill && (teacher.outputActivation() != ActivationType::SOFTMAX || student.outputActivation() != ActivationType::SOFTMAX)) {
+            throw std::runtime_error("--distill requires a softmax output layer in both the teacher and the student.");
+        }
+
+        // Load the data only once the models are known to fit, it takes a while
+        Eigen::MatrixXd data_X = Utilities::loadCSV("data/train_data.csv", 784, 60000);
+        Eigen::MatrixXd data_Y = Utilities::loadCSV("data/train_labels.csv", 10, 60000);
+        Eigen::MatrixXd train_X, train_Y, eval_X, eval_Y;
+        std::string eval_name;
+        if (!config.eval_data.empty()) {
+            train_X = std::move(data_X);
+            train_Y = std::move(data_Y);
+            eval_X = Utilities::loadCSV(config.eval_data, 784, config.eval_samples);
+            eval_Y = Utilities::loadCSV(config.eval_labels, 10, config.eval_samples);
+            eval_name = "Accuracy (" + config.eval_data + ")";
+        } else {
+            // Keep the last 10000 samples out of fine-tuning. train fits the original on all 60000
+            // and a pruned student starts from those weights, so they are not held out for either
+            train_X = data_X.leftCols(50000);
+            train_Y = data_Y.leftCols(50000);
+            eval_X = data_X.rightCols(10000);
+            eval_Y = data_Y.rightCols(10000);
+            eval_name = "Accuracy (last 10000 train samples, not held out)";
+        }
+
+        if (config.prune_ratio > 0.0) {
+            student.pruneNeurons(config.prune_ratio, train_X.leftCols(2000));
+            std::cout << "Pruned to " << topology(student.layerSizes()) << std::endl;
+        }
+
+        // Fine-tune on the hard labels, or distill from the teacher at the chosen temperature
+        if (config.epochs > 0) {
+            if (config.distill) {
+                Eigen::MatrixXd soft_Y = softTargets(teacher, train_X, config.temperature);
+                student.distill(train_X, train_Y, soft_Y, config.epochs, config.learning_rate, config.temperature, config.alpha);
+            } else {
+                student.train(train_X, train_Y, config.epochs, config.learning_rate, LossType::CROSS_ENTROPY);
+            }
+        }
+
+        student.saveWeights(config.weights_out);
+        std::cout << "Weights saved to " << config.weights_out << "\n\n";
+
+        std::cout << std::left << std::setw(12) << "Model" << std::setw(28) << "Topology"
+                  << std::setw(12) << "Params" << std::setw(14) << "FLOPs/sample"
+                  << std::setw(14) << "Latency (ms)" << eval_name << "\n";
+        printReport("original", teacher, eval_X, eval_Y);
+        printReport("compressed", student, eval_X, eval_Y);
+
+    } catch (const std::runtime_error &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -7,17 +7,12 @@ int main(int argc, char** argv) {
         NetworkConfig config = Utilities::parseArguments(argc, argv);
 
         // Convert activation strings to ActivationType enum
-        std::vector<ActivationType> activations;
-        for (auto &as : config.activation_strs) {
-            if (as == "sigmoid") {
-                activations.push_back(ActivationType::SIGMOID);
-            } else if (as == "relu") {
-                activations.push_back(ActivationType::RELU);
-            } else if (as == "softmax") {
-                activations.push_back(ActivationType::SOFTMAX);
-            } else {
-                throw std::runtime_error("Unknown activation function: " + as);
-            }
+        std::vector<ActivationType> activations = Utilities::toActivationTypes(config.activation_strs);
+
+        // Place the weights and the dataset according to the NUMA policy before first touch
+        Numa::applyToCurrentThread(config.numa_policy, Numa::nodes().front());
+        if (config.numa_policy != NumaPolicy::NONE && !Numa::available()) {
+            std::cout << "Single NUMA node, --numa " << Numa::policyName(config.numa_policy) << " has no effect\n";
         }
 
         // Initialize MLP